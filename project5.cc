@@ -8,9 +8,25 @@
 * Based on files by Dr. Bjork
 */
 
+#include <cstdlib>
+#include <exception>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include "./province.h"
+#include "./resultcache.h"
+#include "./sharedprovince.h"
+#include "./streamprovince.h"
+
+// Tag for the output of analyze() in the result cache, changing with the
+// sources so cached results of an older build are not reused. The
+// Makefile passes a checksum of the sources; other builds fall back to
+// the time of compilation.
+#ifndef SOURCES_CHECKSUM
+#define SOURCES_CHECKSUM __DATE__ " " __TIME__
+#endif
+const char RESULTS_FORMAT[] = "project5 results " SOURCES_CHECKSUM;
 
 /*
 * check if we are at the end of the file
@@ -30,12 +46,30 @@ bool eof() {
     }
 }
 
-int main(int argc, char *argv[]) {
-    // Repeatedly read input from standard input
+/*
+* Read a size given on the command line
+* @param text Argument to read
+* @param what What the size counts, for errors
+* @return Size, which is always positive
+*/
+long positiveNumber(const char *text, const std::string & what) {
+    char *end;
+    long number = std::strtol(text, &end, 10);
+    if (*end != '\0' || number <= 0) {
+        throw std::runtime_error(std::string(text) +
+                                 " is not a positive number of " + what);
+    }
+    return number;
+}
+
+/*
+* Print only the minimum spanning tree and isolated groups of each
+* province, without ever holding all of its roads in memory
+* @param chunkSize Number of roads to hold in memory at a time
+*/
+void streamAll(int chunkSize) {
     while (!eof()) {
-        // create a new graph for each loop, which will read all of the
-        // corresponding data per graph
-        Province theProvince(std::cin);
+        StreamingProvince theProvince(std::cin, chunkSize);
 
         std::cout << std::endl;
         std::cout << "------------------------------------------------" << std::endl;
@@ -43,43 +77,216 @@ int main(int argc, char *argv[]) {
         std::cout << "------------------------------------------------" << std::endl;
         std::cout << std::endl;
 
-        // call the breadth first search function on the new graph
-        // to print out ('echo') all of the corresponding data
-        // as specified in the project description
-        theProvince.printAll(0, std::cout);
+        theProvince.minSpan(std::cout);
 
         std::cout << std::endl;
         std::cout << "------------------------------------------------" << std::endl;
         std::cout << "------------------------------------------------" << std::endl;
         std::cout << std::endl;
 
-        theProvince.printShortest(std::cout);
+        theProvince.removeBridges(std::cout);
 
         std::cout << std::endl;
         std::cout << "------------------------------------------------" << std::endl;
         std::cout << "------------------------------------------------" << std::endl;
         std::cout << std::endl;
+    }
+}
 
-        theProvince.minSpan(std::cout);
+/*
+* Print every analysis of a province, as specified in the project
+* description
+* @param theProvince Province to analyze
+* @param output Stream to print to
+* @param stormRoutes Whether to also print the routes if all bridges fail
+*/
+void analyze(const ProvinceGraph & theProvince, std::ostream & output,
+             bool stormRoutes) {
+    output << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << "---------------- New DataSet: ------------------" << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << std::endl;
 
-        std::cout << std::endl;
-        std::cout << "------------------------------------------------" << std::endl;
-        std::cout << "------------------------------------------------" << std::endl;
-        std::cout << std::endl;
+    // call the breadth first search function on the new graph
+    // to print out ('echo') all of the corresponding data
+    // as specified in the project description
+    theProvince.printAll(0, output);
 
-        theProvince.removeBridges(std::cout);
+    output << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << std::endl;
 
-        std::cout << std::endl;
-        std::cout << "------------------------------------------------" << std::endl;
-        std::cout << "------------------------------------------------" << std::endl;
-        std::cout << std::endl;
-        /*
-        theProvince.articulationPoints(std::cout);
+    // Find the shortest routes once; any storm routes repair them
+    ProvinceGraph::Routes routes = theProvince.shortestRoutes();
+    theProvince.printShortest(routes, output);
 
-        std::cout << std::endl;
-        std::cout << "------------------------------------------------" << std::endl;
-        std::cout << "------------------------------------------------" << std::endl;
-        std::cout << std::endl;
-        */
+    output << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << std::endl;
+
+    if (stormRoutes) {
+        theProvince.printStormShortest(routes, output);
+
+        output << std::endl;
+        output << "------------------------------------------------" << std::endl;
+        output << "------------------------------------------------" << std::endl;
+        output << std::endl;
+    }
+
+    theProvince.minSpan(output);
+
+    output << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << std::endl;
+
+    theProvince.removeBridges(output);
+
+    output << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << std::endl;
+    /*
+    theProvince.articulationPoints(output);
+
+    output << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << "------------------------------------------------" << std::endl;
+    output << std::endl;
+    */
+}
+
+/*
+* Name of the shared memory segment holding a data set
+* @param prefix Name given on the command line, starting with '/'
+* @param dataSet Index of data set in input
+* @return Name of segment
+*/
+std::string segmentName(const std::string & prefix, int dataSet) {
+    std::ostringstream name;
+    name << prefix << "-" << dataSet;
+    return name.str();
+}
+
+/*
+* Print the analyses of each province published under prefix, attaching
+* to the shared copy instead of reading it in again
+* @param prefix Name the provinces were published under
+* @param stormRoutes Whether to also print the routes if all bridges fail
+*/
+void attachAll(const std::string & prefix, bool stormRoutes) {
+    if (!SharedProvince::isPublished(segmentName(prefix, 0))) {
+        throw std::runtime_error("Nothing published under " + prefix);
+    }
+
+    for (int dataSet = 0; SharedProvince::isPublished(segmentName(prefix,
+         dataSet)); dataSet++) {
+        SharedProvince theProvince(segmentName(prefix, dataSet));
+
+        analyze(theProvince, std::cout, stormRoutes);
+    }
+}
+
+/*
+* Run the mode chosen on the command line
+* @return Exit status
+*/
+int run(int argc, char *argv[]) {
+    // -r, ahead of any other mode, adds the routes if all bridges fail
+    bool stormRoutes = (argc > 1 && std::string(argv[1]) == "-r");
+    if (stormRoutes) {
+        argc--;
+        argv++;
+    }
+
+    std::string mode = (argc > 1) ? argv[1] : "";
+
+    // -s [roads] streams provinces too large to fit in memory, holding
+    // at most that many roads in memory at a time
+    if (mode == "-s") {
+        long chunkSize = 1 << 20;
+        if (argc > 2) {
+            chunkSize = positiveNumber(argv[2], "roads");
+        }
+        streamAll(chunkSize);
+        return 0;
+    }
+
+    // -p /name publishes each province into shared memory as /name-0,
+    // /name-1, ...; -a /name attaches to them; -u /name removes them
+    if (argc > 2 && mode == "-p") {
+        for (int dataSet = 0; !eof(); dataSet++) {
+            SharedProvince::publish(std::cin, segmentName(argv[2], dataSet));
+        }
+        return 0;
+    } else if (argc > 2 && mode == "-a") {
+        attachAll(argv[2], stormRoutes);
+        return 0;
+    } else if (argc > 2 && mode == "-u") {
+        if (!SharedProvince::isPublished(segmentName(argv[2], 0))) {
+            throw std::runtime_error(std::string("Nothing published under ") +
+                                     argv[2]);
+        }
+        for (int dataSet = 0; SharedProvince::isPublished(segmentName(argv[2],
+             dataSet)); dataSet++) {
+            SharedProvince::unpublish(segmentName(argv[2], dataSet));
+        }
+        return 0;
+    }
+
+    // -c dir [megabytes] reuses results of data sets seen before
+    if (argc > 2 && mode == "-c") {
+        long megabytes = 64;
+        if (argc > 3) {
+            megabytes = positiveNumber(argv[3], "megabytes");
+        }
+        // Results with and without storm routes are cached apart
+        std::string format = RESULTS_FORMAT;
+        if (stormRoutes) {
+            format += " with storm routes";
+        }
+        ResultCache cache(argv[2], megabytes * 1024 * 1024, format);
+
+        while (!eof()) {
+            std::string dataSet = ResultCache::readDataSet(std::cin);
+            std::string results;
+
+            // Only parse and analyze data sets not already cached
+            if (!cache.lookup(dataSet, results)) {
+                std::istringstream source(dataSet);
+                Province theProvince(source);
+                std::ostringstream output;
+                analyze(theProvince, output, stormRoutes);
+                results = output.str();
+                cache.store(dataSet, results);
+            }
+
+            std::cout << results;
+        }
+        return 0;
+    }
+
+    // Repeatedly read input from standard input
+    while (!eof()) {
+        // create a new graph for each loop, which will read all of the
+        // corresponding data per graph
+        Province theProvince(std::cin);
+
+        analyze(theProvince, std::cout, stormRoutes);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    // Report failures such as a segment already published, rather
+    // than aborting
+    try {
+        return run(argc, argv);
+    } catch (const std::exception & error) {
+        std::cerr << argv[0] << ": " << error.what() << std::endl;
+        return 1;
     }
 }
@@ -9,12 +9,14 @@
 #include <list>
 #include <map>
 #include <queue>
+#include <vector>
+#include "./provincegraph.h"
 
 /**
  * Province
  * Contains towns connected by roads
  */
-class Province
+class Province : public ProvinceGraph
 {
 public:
 
@@ -24,25 +26,12 @@ public:
      */
     Province(std::istream & source);
 
-    /**
-     * Print towns and roads in province in breadth-first search order
-     * @param start Index to start traversal at
-     * @param output Stream to print data to
-     */
-    void printAll(int start, std::ostream & output) const;
-
-    void printShortest(std::ostream & output) const;
-
 
     /**
      * Find shortest path from one town to another
      */
     void findShortestPath();
 
-    void minSpan(std::ostream & output) const;
-
-    void removeBridges(std::ostream & output) const;
-
     void articulationPoints(std::ostream & output) const;
 
     void dfs(std::vector<int> & dfsTowns) const;
@@ -52,40 +41,23 @@ public:
      */
     ~Province() { delete [] _towns; }
 
-private:
+protected:
 
-    int smallest(double dist [], std::list <int> toVisit, int numTowns) const;
-    std::vector<int> bfs(int start) const;
-    void dfsAux(int current, std::vector<int> & dfsTowns, bool visited []) const;
+    int numberOfTowns() const { return _numberOfTowns; }
+    int numberOfRoads() const { return _numberOfRoads; }
+    const char * name(int town) const { return _towns[town]._name.c_str(); }
 
+    int numberOfEnds(int town) const { return _towns[town]._roads.size(); }
 
+    const Road & end(int town, int index) const {
+        return _towns[town]._roads[index];
+    }
 
-    /**
-     * Road
-     * Contains index of originating town, whether or not is bridge,
-     * and length
-     */
-    class Road
-    {
-    public:
+    const Road & road(int index) const { return _roads[index]; }
 
-        /*
-         * Constructor
-         * @param head Index in vertex array of originating town
-         * @param isBridge Whether or not the road is a bridge
-         * @param length Length of the road in miles
-         */
-        Road(int head, int tail, bool isBridge, double length)
-            : _head(head), _tail(tail), _isBridge(isBridge), _length(length)
-        {}
-
-        int _head; // Index of originating town in vertex array
-        int _tail;
-        bool _isBridge;
-        double _length;
-
-        bool operator < (Road road2) const;
-    };
+private:
+
+    void dfsAux(int current, std::vector<int> & dfsTowns, bool visited []) const;
 
     /**
      * Town
@@ -95,7 +67,7 @@ private:
     {
     public:
         std::string _name;
-        typedef std::list <Road> RoadList;
+        typedef std::vector <Road> RoadList;
         RoadList _roads;
     };
 
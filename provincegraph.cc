@@ -0,0 +1,541 @@
+/*
+* Implementation of provincegraph.h
+* Copyright 2016 Adam Vigneaux and Jordan Hunt
+* Based on algorithms by Dr. Bjork
+*/
+
+#include "./provincegraph.h"
+#include "./unionfind.h"
+#include <algorithm>
+#include <cfloat>
+#include <functional>
+#include <queue>
+#include <stack>
+#include <utility>
+
+/**
+ * Print list of towns and roads in province in
+ * breadth-first search order
+ * @param start Index to start traversal at
+ * @param output Output stream to write to
+ */
+void ProvinceGraph::printAll(int start, std::ostream &output) const {
+
+    // Keep track of whether a vertex has been scheduled to be visited, lest
+    // we get into a loop
+    bool scheduled[numberOfTowns()];
+    for (int i = 0; i < numberOfTowns(); i++) {
+        scheduled[i] = false;  // default false value for each vertex
+    }
+
+    // keeps track of which vertices have been visited
+    // queue to keep track of which vertex to visit next
+    std::queue <int> toVisit;
+    toVisit.push(start);
+    scheduled[start] = true;
+    output << "The input data is:" << std::endl << std::endl;
+
+    // Visit each town in queue
+    while (!toVisit.empty()) {
+        // Visit front vertex in the queue
+        int current = toVisit.front();
+        toVisit.pop();
+
+        output << "      ";
+        output << name(current) << std::endl;
+
+        // Enqueue current vertex's unscheduled neighbors
+        for (int endIndex = 0; endIndex < numberOfEnds(current);
+             endIndex++) {
+            const Road & neighbor = end(current, endIndex);
+            const char *neighborName = name(neighbor._head);
+
+            output << "            ";
+            output << neighborName << " " << neighbor._length << " mi";
+
+            // if the type is bridge, then add to output
+            if (neighbor._isBridge) {
+                output << " via bridge";
+            }
+
+            output << std::endl;
+
+            int head = neighbor._head;
+
+            // Add neighbor to queue if not scheduled
+            if (!scheduled[head]) {
+                toVisit.push(head);
+                scheduled[head] = true;
+            }
+        }
+    }
+
+    output << std::endl << std::endl;
+}
+
+int ProvinceGraph::smallest(double dist[], std::list <int> toVisit,
+    int numTowns) const {
+    int smallest = toVisit.front();
+
+    if (toVisit.size() > 1) {
+        for (int i = 0; i < numTowns; i++) {
+            if (dist[i] < dist[smallest]) {
+                bool found = (std::find(toVisit.begin(), toVisit.end(), i)
+                                != toVisit.end());
+                if (found) {
+                    smallest = i;
+                }
+            }
+        }
+    }
+    return smallest;
+}
+
+/**
+* Compute the shortest route from the capital to each of the other towns
+* algorithm found at graphs lecture notes under
+* "Single-Source" All Destinations Shortest Path
+* @return Distance to and predecessor of each town on its route, and
+*         whether it is reached from its predecessor by a bridge
+*/
+ProvinceGraph::Routes ProvinceGraph::shortestRoutes() const {
+    Routes routes;
+
+    // keeps track of the distance from the capital to each town
+    // following the shortest path
+    std::vector<double> & dist = routes._dist;
+
+    // keeps track of the index of the predecessor to each
+    // vertex n on the shortest path to n
+    std::vector<int> & prev = routes._prev;
+
+    // set defaults for dist, prev, and add all vertices to toVisit
+    dist.assign(numberOfTowns(), DBL_MAX);
+    prev.assign(numberOfTowns(), -1);
+    routes._viaBridge.assign(numberOfTowns(), false);
+
+    // queue to keep track of which vertex to visit next
+    std::list <int> toVisit;
+    for (int i = 0; i < numberOfTowns(); i++) {
+        toVisit.push_back(i);
+    }
+
+    // distance from the capital to the capital is zero
+    dist[0] = 0.0;
+
+    while (!toVisit.empty()) {
+        int smallestIndex = smallest(&dist[0], toVisit, numberOfTowns());
+
+        toVisit.remove(smallestIndex);
+
+        // Enqueue current vertex's neighbors
+        for (int endIndex = 0; endIndex < numberOfEnds(smallestIndex);
+             endIndex++) {
+            const Road & neighbor = end(smallestIndex, endIndex);
+            // new distance needed for testing
+            double newDist = dist[smallestIndex] + neighbor._length;
+
+            // if new dist is smaller, replace the old one, and
+            // update the corresponding entry in prev
+            if (newDist < dist[neighbor._head]) {
+                dist[neighbor._head] = newDist;
+                prev[neighbor._head] = smallestIndex;
+                routes._viaBridge[neighbor._head] = neighbor._isBridge;
+            }
+        }
+    }
+
+    return routes;
+}
+
+/**
+* Print the route to a town by following the links in prev
+* back to the capital
+* @param town Index of town the route ends at
+* @param prev Predecessor of each town on its route
+* @param output stream to write to
+*/
+void ProvinceGraph::printRoute(int town, const std::vector<int> & prev,
+    std::ostream & output) const {
+
+    // stack to hold the path to the town
+    std::stack <int> predecessors;
+
+    // add town to stack
+    int predecessor = town;
+    predecessors.push(town);
+
+    // follow the links in prev until we get to the capital,
+    // adding each town to the predecessor stack
+    while (predecessor != 0) {
+        predecessor = prev[predecessor];
+        predecessors.push(predecessor);
+    }
+
+    // print out the names for each entry in the stack
+    while (!predecessors.empty()) {
+        output << "            " << name(predecessors.top());
+        output << std::endl;
+        predecessors.pop();
+    }
+}
+
+/**
+* Print the shortest route from the capital of the
+* province to each of the other towns
+* @param output stream to write to
+*/
+void ProvinceGraph::printShortest(std::ostream & output) const {
+    printShortest(shortestRoutes(), output);
+}
+
+/**
+* Print the shortest route from the capital of the
+* province to each of the other towns
+* @param routes Routes found by shortestRoutes
+* @param output stream to write to
+*/
+void ProvinceGraph::printShortest(const Routes & routes,
+    std::ostream & output) const {
+
+    // Bypass entire function if only one town
+    if (numberOfTowns() == 1) {
+        output << "There is only one town, so the provincial "
+               << "officials have no need of efficient routes!";
+        return;
+    }
+
+    output << "The shortest routes from " << name(0);
+    output << " are:" << std::endl << std::endl;
+
+    // print out the data for each non capital town
+    for (int i = 1; i < numberOfTowns(); i++) {
+        if (routes._dist[i] == DBL_MAX) {
+            output << "      " << name(i);
+            output << " cannot be reached from " << name(0) << std::endl;
+            continue;
+        }
+
+        output << "      " << "The shortest route from " << name(0);
+        output << " to " << name(i) << " is " << routes._dist[i];
+        output << " mi:" << std::endl;
+
+        printRoute(i, routes._prev, output);
+    }
+}
+
+/**
+* Print the shortest route from the capital of the province to each
+* of the other towns if all bridges fail
+* @param output stream to write to
+*/
+void ProvinceGraph::printStormShortest(std::ostream & output) const {
+    printStormShortest(shortestRoutes(), output);
+}
+
+/**
+* Print the shortest route from the capital of the province to each
+* of the other towns if all bridges fail
+* 1. Start from the normal shortest routes from the capital
+* 2. Keep every town whose route uses no bridge, since a route that is
+*    shortest with bridges and uses none is also shortest without them
+* 3. Discard the rest - the subtrees hanging below a bridge road - and
+*    re-settle only those towns, ignoring bridges, starting from the
+*    kept towns that border them
+* @param routes Routes found by shortestRoutes
+* @param output stream to write to
+*/
+void ProvinceGraph::printStormShortest(const Routes & routes,
+    std::ostream & output) const {
+
+    // Bypass entire function if only one town
+    if (numberOfTowns() == 1) {
+        output << "There is only one town, so the provincial "
+               << "officials have no need of storm routes!";
+        return;
+    }
+
+    output << "The shortest routes from " << name(0);
+    output << " if all bridges fail are:" << std::endl << std::endl;
+
+    // Repaired copy of the normal routes
+    std::vector<double> dist = routes._dist;
+    std::vector<int> prev = routes._prev;
+
+    // A town must be re-settled if its route crosses a bridge anywhere,
+    // so walk up each route until reaching a town already decided
+    std::vector<bool> decided(numberOfTowns(), false);
+    std::vector<bool> unsettled(numberOfTowns(), false);
+    decided[0] = true;
+
+    for (int i = 0; i < numberOfTowns(); i++) {
+        std::stack <int> route;
+        int town = i;
+        while (!decided[town] && dist[town] != DBL_MAX) {
+            route.push(town);
+            town = prev[town];
+        }
+
+        // Towns never reached at all cannot be reached in a storm either
+        if (!decided[town]) {
+            decided[town] = true;
+            unsettled[town] = true;
+        }
+
+        // Decide the route from the top down
+        while (!route.empty()) {
+            int current = route.top();
+            route.pop();
+            decided[current] = true;
+            unsettled[current] = routes._viaBridge[current] ||
+                unsettled[prev[current]];
+        }
+    }
+
+    // Only the unsettled towns need to be visited again, closest first
+    typedef std::pair<double, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>,
+                        std::greater<Entry> > toVisit;
+
+    // Seed each unsettled town from its settled neighbors
+    for (int town = 0; town < numberOfTowns(); town++) {
+        if (!unsettled[town]) {
+            continue;
+        }
+
+        dist[town] = DBL_MAX;
+        for (int endIndex = 0; endIndex < numberOfEnds(town);
+             endIndex++) {
+            const Road & neighbor = end(town, endIndex);
+            if (neighbor._isBridge || unsettled[neighbor._head]) {
+                continue;
+            }
+
+            double newDist = dist[neighbor._head] + neighbor._length;
+            if (newDist < dist[town]) {
+                dist[town] = newDist;
+                prev[town] = neighbor._head;
+            }
+        }
+
+        if (dist[town] != DBL_MAX) {
+            toVisit.push(Entry(dist[town], town));
+        }
+    }
+
+    // Re-settle the unsettled towns, ignoring bridges; towns never
+    // queued cannot be reached without a bridge
+    while (!toVisit.empty()) {
+        Entry closest = toVisit.top();
+        toVisit.pop();
+
+        // Skip entries left behind by a shorter route found later
+        int smallestIndex = closest.second;
+        if (closest.first > dist[smallestIndex]) {
+            continue;
+        }
+
+        for (int endIndex = 0; endIndex < numberOfEnds(smallestIndex);
+             endIndex++) {
+            const Road & neighbor = end(smallestIndex, endIndex);
+            if (neighbor._isBridge) {
+                continue;
+            }
+
+            double newDist = dist[smallestIndex] + neighbor._length;
+            if (newDist < dist[neighbor._head]) {
+                dist[neighbor._head] = newDist;
+                prev[neighbor._head] = smallestIndex;
+                toVisit.push(Entry(newDist, neighbor._head));
+            }
+        }
+    }
+
+    // print out the data for each non capital town
+    for (int i = 1; i < numberOfTowns(); i++) {
+        if (dist[i] == DBL_MAX) {
+            output << "      " << name(i);
+            output << " cannot be reached from " << name(0);
+            output << " if all bridges fail" << std::endl;
+            continue;
+        }
+
+        output << "      " << "The shortest route from " << name(0);
+        output << " to " << name(i) << " is " << dist[i];
+        output << " mi:" << std::endl;
+
+        printRoute(i, prev, output);
+    }
+}
+
+/**
+ * Overloads operator < when used to compare two roads
+ * @param road2 A road
+ * @return      True if road1 is shorter in length than road 2
+ */
+bool ProvinceGraph::Road::operator < (Road road2) const {
+    return this->_length < road2._length;
+}
+
+/**
+ * Find minimum spanning tree of the province
+ * @param output Stream to print output to
+ */
+void ProvinceGraph::minSpan(std::ostream & output) const {
+
+    // Bypass entire function if only one town
+    if (numberOfTowns() == 1) {
+        output << "There is only one town, so the province "
+               << "does not need to upgrade any roads!";
+        return;
+    }
+    
+    std::list<Road> roads;
+    std::vector<Road> minSpanTree;
+
+    // Add all roads to list of roads
+    for (int i = 0; i < numberOfRoads(); i++) {
+        roads.push_back(road(i));
+    }
+
+    // Sort list of roads by length; the sort is stable, so roads of
+    // equal length stay in input order
+    roads.sort();
+
+    // Take the shortest remaining road unless both of its towns are
+    // already in the same component, since it would form a cycle
+    UnionFind components(numberOfTowns());
+    while (minSpanTree.size() < numberOfTowns() - 1 && !roads.empty()) {
+        Road minRoad = roads.front();
+        roads.pop_front();
+
+        if (components.join(minRoad._head, minRoad._tail)) {
+            minSpanTree.push_back(minRoad);
+        }
+    }
+
+    output << "The road upgrading goal can be achieved at minimal cost by upgrading:";
+    output << std::endl << std::endl;
+
+    // Print names of towns in minimum spanning tree of province
+    for (int i = 0; i < minSpanTree.size(); i++) {
+        output << "      ";
+        output << name(minSpanTree[i]._head);
+        output << " to ";
+        output << name(minSpanTree[i]._tail) << std::endl;
+    }
+}
+
+/**
+ * Conduct a breadth-first traversal on the province, ignoring bridges
+ * @param start Index of town to start traversal at
+ * @return      List of indices of towns in order of traversal
+ */
+std::vector<int> ProvinceGraph::bfs(int start) const {
+    // Initialize list of towns scheduled to visit
+    bool scheduled[numberOfTowns()];
+    for (int i = 0; i < numberOfTowns(); i ++) {
+        scheduled[i] = false;
+    }
+
+    // Initialize list of towns to visit with starting town
+    std::queue<int> toVisit;
+    toVisit.push(start);
+
+    scheduled[start] = true;
+    std::vector<int> results;
+
+    // While all towns have not been visited
+    while (!toVisit.empty()) {
+
+        // Remove current town from queue, add to results
+        int current = toVisit.front();
+        toVisit.pop();
+        results.push_back(current);
+
+        // Iterate over neighbors to current town
+        for (int endIndex = 0; endIndex < numberOfEnds(current);
+             endIndex++) {
+            const Road & neighbor = end(current, endIndex);
+
+            // If neighbor is not bridge and is not scheduled,
+            // add to results and schedule
+            if (!neighbor._isBridge && !scheduled[neighbor._head]) {
+                toVisit.push(neighbor._head);
+                scheduled[neighbor._head] = true;
+            }
+        }
+    }
+
+    return results;
+}
+
+/**
+ * Remove bridges and print the list of towns that remain connected
+ * 1. Remove all bridges
+ * 2. Make a list of towns to visit
+ * 3. Run a BFS from a town, remove that town and all reached towns
+ *    from list to visit, then print all towns in that connected
+ *    component.
+ * 4. Repeat step 3 for all remaining towns.
+ * @param output Stream to print output to
+ */
+void ProvinceGraph::removeBridges(std::ostream &output) const {
+
+    // Look for a bridge
+    bool hasBridge = false;
+    for (int roadNum = 0; roadNum < numberOfRoads(); roadNum++) {
+        if (road(roadNum)._isBridge) {
+            hasBridge = true;
+            break;
+        }
+    }
+    
+    // Bypass entire function if only one town
+    if (numberOfTowns() == 1) {
+        output << "There is only one town, so the province "
+               << "will not be affected by a major storm!";
+        return;
+
+    // Bypass entire function if province has no bridges
+    } else if (!hasBridge) {
+        output << "The province has no bridges, so it "
+               << "will not be affected by a major storm!";
+        return;
+    }
+    
+    // Mark all towns as unvisited
+    std::list<int> toVisit;
+    for (int i = 0; i < numberOfTowns(); i++) {
+        toVisit.push_back(i);
+    }
+
+    output << "Connected components in event of a major storm are: ";
+    output << std::endl << std::endl;
+
+    // While not all towns have been visited
+    while (!toVisit.empty()) {
+
+        // Mark current town as visited
+        int curr = toVisit.back();
+        toVisit.pop_back();
+
+        // Run BFS from current town
+        std::vector<int> bfsResult = bfs(curr);
+
+        // Mark all towns in BFS result as visited
+        for (int i = 0; i < bfsResult.size(); i++) {
+            toVisit.remove(bfsResult[i]);
+        }
+
+        output << "      ";
+        output << "If all bridges fail, the following towns would form ";
+        output << "an isolated group:" << std::endl;
+
+        // Print names of all towns in connected component
+        for (int i = 0; i < bfsResult.size(); i++) {
+            output << "            ";
+            output << name(bfsResult[i]) << std::endl;
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Class declaration for ProvinceGraph
+ * Copyright Adam Vigneaux and Jordan Hunt
+ * Based on files by Dr. Bjork
+*/
+
+#ifndef PROVINCEGRAPH_H
+#define PROVINCEGRAPH_H
+
+#include <iostream>
+#include <list>
+#include <vector>
+
+/**
+ * ProvinceGraph
+ * Read-only view of towns connected by roads, and the analyses run on
+ * it. Subclasses decide where the towns and roads are kept.
+ */
+class ProvinceGraph
+{
+public:
+
+    /**
+     * Road
+     * Contains index of originating town, whether or not is bridge,
+     * and length
+     */
+    class Road
+    {
+    public:
+
+        /*
+         * Constructor
+         * @param head Index in vertex array of originating town
+         * @param isBridge Whether or not the road is a bridge
+         * @param length Length of the road in miles
+         */
+        Road(int head, int tail, bool isBridge, double length)
+            : _head(head), _tail(tail), _isBridge(isBridge), _length(length)
+        {}
+
+        int _head; // Index of originating town in vertex array
+        int _tail;
+        bool _isBridge;
+        double _length;
+
+        bool operator < (Road road2) const;
+    };
+
+    /**
+     * Print towns and roads in province in breadth-first search order
+     * @param start Index to start traversal at
+     * @param output Stream to print data to
+     */
+    void printAll(int start, std::ostream & output) const;
+
+    /**
+     * Shortest routes from the capital to every town
+     */
+    struct Routes
+    {
+        std::vector<double> _dist;    // DBL_MAX if unreachable
+        std::vector<int> _prev;       // Predecessor on route, -1 if none
+        std::vector<bool> _viaBridge; // Reached from _prev by a bridge
+    };
+
+    /**
+     * Find shortest routes from the capital, to be shared by
+     * printShortest and printStormShortest
+     * @return Routes to every town
+     */
+    Routes shortestRoutes() const;
+
+    void printShortest(std::ostream & output) const;
+    void printShortest(const Routes & routes, std::ostream & output) const;
+
+    /**
+     * Print shortest routes from the capital if all bridges fail
+     * @param output Stream to print data to
+     */
+    void printStormShortest(std::ostream & output) const;
+
+    /**
+     * Print shortest routes from the capital if all bridges fail,
+     * repairing the normal routes rather than recomputing them
+     * @param routes Routes found by shortestRoutes
+     * @param output Stream to print data to
+     */
+    void printStormShortest(const Routes & routes,
+                            std::ostream & output) const;
+
+    void minSpan(std::ostream & output) const;
+
+    void removeBridges(std::ostream & output) const;
+
+    virtual ~ProvinceGraph() {}
+
+protected:
+
+    virtual int numberOfTowns() const = 0;
+    virtual int numberOfRoads() const = 0;
+    virtual const char * name(int town) const = 0;
+
+    /**
+     * Roads leaving a town, in input order; the road's _head is the
+     * town at the other end and its _tail is this town
+     */
+    virtual int numberOfEnds(int town) const = 0;
+    virtual const Road & end(int town, int index) const = 0;
+
+    /**
+     * Roads in input order; _tail is the first town named
+     */
+    virtual const Road & road(int index) const = 0;
+
+private:
+
+    int smallest(double dist [], std::list <int> toVisit, int numTowns) const;
+    void printRoute(int town, const std::vector<int> & prev,
+                    std::ostream & output) const;
+    std::vector<int> bfs(int start) const;
+};
+
+#endif
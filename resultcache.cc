@@ -0,0 +1,243 @@
+/*
+* Implementation of resultcache.h
+* Copyright 2016 Adam Vigneaux and Jordan Hunt
+*/
+
+#include "./resultcache.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Extension of result files, so nothing else in the directory is evicted
+const char EXTENSION[] = ".out";
+
+/*
+ * 64-bit FNV-1a hash
+ */
+unsigned long long hash(const std::string & text) {
+    unsigned long long value = 14695981039346656037ULL;
+    for (int i = 0; i < text.size(); i++) {
+        value ^= static_cast<unsigned char>(text[i]);
+        value *= 1099511628211ULL;
+    }
+    return value;
+}
+
+/*
+ * Result file and when it was last used
+ */
+struct CachedFile {
+    std::string _path;
+    struct timespec _used;
+    off_t _size;
+};
+
+/*
+ * Order result files by last use, to the nanosecond
+ */
+bool usedEarlier(const CachedFile & file1, const CachedFile & file2) {
+    if (file1._used.tv_sec != file2._used.tv_sec) {
+        return file1._used.tv_sec < file2._used.tv_sec;
+    }
+    return file1._used.tv_nsec < file2._used.tv_nsec;
+}
+
+/*
+ * Mark a result file used now; the clock is read directly since file
+ * times set by the kernel may be too coarse to order uses in one run
+ */
+void markUsed(const std::string & file) {
+    struct timespec now[2];
+    clock_gettime(CLOCK_REALTIME, &now[0]);
+    now[1] = now[0];
+    utimensat(AT_FDCWD, file.c_str(), now, 0);
+}
+
+bool hasExtension(const std::string & name) {
+    size_t length = sizeof(EXTENSION) - 1;
+    return name.size() > length &&
+           name.compare(name.size() - length, length, EXTENSION) == 0;
+}
+
+}  // namespace
+
+/*
+* Constructor
+* @param directory Directory to keep results in
+* @param maxBytes Most bytes of results to keep
+* @param format Tag for the program producing the results
+*/
+ResultCache::ResultCache(const std::string &directory, long maxBytes,
+                         const std::string &format)
+    : _directory(directory), _maxBytes(maxBytes), _format(format) {
+    if (mkdir(_directory.c_str(), 0755) == -1 && errno != EEXIST) {
+        throw std::runtime_error("Could not create cache " + _directory);
+    }
+}
+
+/*
+* Read one data set in canonical form, so data sets that differ only in
+* spacing share results
+* @param source File containing province, as read by Province
+* @return       Data set as canonical text
+*/
+std::string ResultCache::readDataSet(std::istream &source) {
+    std::ostringstream dataSet;
+
+    int numberOfTowns, numberOfRoads;
+    source >> numberOfTowns >> numberOfRoads;
+    dataSet << numberOfTowns << " " << numberOfRoads << "\n";
+
+    // Town names
+    for (int i = 0; i < numberOfTowns; i++) {
+        std::string name;
+        source >> name;
+        dataSet << name << "\n";
+    }
+
+    // Roads: two towns, type and length, with the length kept as typed
+    for (int i = 0; i < numberOfRoads; i++) {
+        std::string tail, head, type, length;
+        source >> tail >> head >> type >> length;
+        dataSet << tail << " " << head << " " << type << " " << length
+                << "\n";
+    }
+
+    return dataSet.str();
+}
+
+/*
+* Start of the file holding a data set's results: the format, then the
+* length of the data set and the data set itself
+* @param dataSet Data set as returned by readDataSet
+* @return        Text the file starts with
+*/
+std::string ResultCache::header(const std::string &dataSet) const {
+    std::ostringstream header;
+    header << _format << "\n" << dataSet.size() << "\n" << dataSet;
+    return header.str();
+}
+
+/*
+* Name of the file holding a data set's results: the hash of its header,
+* so a new format never finds results of an old one
+* @param dataSet Data set as returned by readDataSet
+* @return        Path of file
+*/
+std::string ResultCache::path(const std::string &dataSet) const {
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx%s", hash(header(dataSet)),
+                  EXTENSION);
+    return _directory + "/" + name;
+}
+
+/*
+* Look up the results for a data set, marking them recently used
+* @param dataSet Data set as returned by readDataSet
+* @param results Set to the stored results if found
+* @return        Whether results were found
+*/
+bool ResultCache::lookup(const std::string &dataSet,
+                         std::string &results) const {
+    std::string file = path(dataSet);
+    std::ifstream cached(file.c_str(), std::ios::binary);
+    if (!cached) {
+        return false;
+    }
+
+    std::ostringstream contents;
+    contents << cached.rdbuf();
+
+    // Only a hit if the file really holds this data set in this format
+    std::string expected = header(dataSet);
+    if (contents.str().compare(0, expected.size(), expected) != 0) {
+        return false;
+    }
+    results = contents.str().substr(expected.size());
+
+    // Eviction goes by modification time
+    markUsed(file);
+    return true;
+}
+
+/*
+* Store the results for a data set
+* Written to a temporary file first and renamed into place, so another
+* process never reads half-written results
+* @param dataSet Data set as returned by readDataSet
+* @param results Results to store
+*/
+void ResultCache::store(const std::string &dataSet,
+                        const std::string &results) {
+    std::string file = path(dataSet);
+    std::ostringstream temporary;
+    temporary << file << "." << getpid() << ".tmp";
+
+    std::ofstream cached(temporary.str().c_str(), std::ios::binary);
+    cached << header(dataSet) << results;
+    cached.close();
+    if (!cached || std::rename(temporary.str().c_str(), file.c_str()) != 0) {
+        std::remove(temporary.str().c_str());
+        return;
+    }
+    markUsed(file);
+}
+
+/*
+* Destructor
+* Evicting once per run rather than on every store keeps a run over
+* many data sets from scanning the directory for each one
+*/
+ResultCache::~ResultCache() {
+    evict();
+}
+
+/*
+* Remove least recently used results until the cache fits its limit
+*/
+void ResultCache::evict() const {
+    DIR *directory = opendir(_directory.c_str());
+    if (directory == NULL) {
+        return;
+    }
+
+    // Collect path, last use and size of each result file
+    std::vector<CachedFile> files;
+    long total = 0;
+    for (dirent *entry = readdir(directory); entry != NULL;
+         entry = readdir(directory)) {
+        std::string name = entry->d_name;
+        struct stat status;
+        std::string file = _directory + "/" + name;
+        if (!hasExtension(name) || stat(file.c_str(), &status) == -1) {
+            continue;
+        }
+        CachedFile cached = { file, status.st_mtim, status.st_size };
+        files.push_back(cached);
+        total += status.st_size;
+    }
+    closedir(directory);
+
+    if (total <= _maxBytes) {
+        return;
+    }
+
+    // Oldest first
+    std::sort(files.begin(), files.end(), usedEarlier);
+    for (int i = 0; i < files.size() && total > _maxBytes; i++) {
+        if (std::remove(files[i]._path.c_str()) == 0) {
+            total -= files[i]._size;
+        }
+    }
+}
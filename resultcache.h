@@ -0,0 +1,77 @@
+/*
+ * Class declaration for ResultCache
+ * Copyright Adam Vigneaux and Jordan Hunt
+ * Based on files by Dr. Bjork
+*/
+
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include <iostream>
+#include <string>
+
+/**
+ * ResultCache
+ * Directory of printed results, one file per data set, named by a hash
+ * of the data set's contents and the format of the results. Each file
+ * also holds the data set itself, so a hash collision is a miss rather
+ * than someone else's results. When the cache is done with, least
+ * recently used files are removed until the directory fits its limit.
+ */
+class ResultCache
+{
+public:
+
+    /**
+     * Constructor
+     * @param directory Directory to keep results in; created if missing
+     * @param maxBytes Most bytes of results to keep
+     * @param format Tag for the program producing the results; results
+     *               stored under any other tag are never returned
+     */
+    ResultCache(const std::string & directory, long maxBytes,
+                const std::string & format);
+
+    /**
+     * Read one data set in canonical form: its tokens, one line for the
+     * counts, one per town and one per road, separated by single spaces
+     * @param source Input data for province, in the same format read
+     *               by Province
+     * @return       Data set as canonical text
+     */
+    static std::string readDataSet(std::istream & source);
+
+    /**
+     * Look up the results for a data set
+     * @param dataSet Data set as returned by readDataSet
+     * @param results Set to the stored results if found
+     * @return        Whether results were found
+     */
+    bool lookup(const std::string & dataSet, std::string & results) const;
+
+    /**
+     * Store the results for a data set
+     * @param dataSet Data set as returned by readDataSet
+     * @param results Results to store
+     */
+    void store(const std::string & dataSet, const std::string & results);
+
+    /**
+     * Destructor
+     * Evict least recently used results, once for the whole run
+     */
+    ~ResultCache();
+
+private:
+
+    std::string path(const std::string & dataSet) const;
+    void evict() const;
+
+    std::string header(const std::string & dataSet) const;
+
+    std::string _directory;
+    long _maxBytes;
+    std::string _format;
+};
+
+#endif
@@ -0,0 +1,318 @@
+/*
+* Implementation of sharedprovince.h
+* Copyright 2016 Adam Vigneaux and Jordan Hunt
+* Based on algorithms by Dr. Bjork
+*/
+
+#include "./sharedprovince.h"
+#include <cerrno>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char MAGIC[8] = "PROVSHM";
+
+// Version of the segment layout; bump whenever Header, Town or Road change
+const int VERSION = 1;
+
+/*
+ * Whether both ends of a road are towns in the segment
+ */
+bool connectsTowns(const ProvinceGraph::Road & road, int numberOfTowns) {
+    return road._head >= 0 && road._head < numberOfTowns &&
+           road._tail >= 0 && road._tail < numberOfTowns;
+}
+
+/*
+ * Round an offset up so the data placed at it is aligned
+ */
+size_t align(size_t offset) {
+    return (offset + sizeof(double) - 1) / sizeof(double) * sizeof(double);
+}
+
+}  // namespace
+
+/*
+* Offset of the first end, just past the towns
+* @param numberOfTowns Number of towns in segment
+*/
+size_t SharedProvince::endsOffset(int numberOfTowns) {
+    return align(sizeof(Header) + numberOfTowns * sizeof(Town));
+}
+
+/*
+* Offset of the first road, just past the ends; every road has two ends
+* @param numberOfTowns Number of towns in segment
+* @param numberOfRoads Number of roads in segment
+*/
+size_t SharedProvince::roadsOffset(int numberOfTowns, int numberOfRoads) {
+    return endsOffset(numberOfTowns) +
+           2 * static_cast<size_t>(numberOfRoads) * sizeof(Road);
+}
+
+/*
+* Read a province and publish it into a new shared memory segment
+* @param source File containing province, as read by Province
+* @param name Name of segment
+*/
+void SharedProvince::publish(std::istream &source, const std::string &name) {
+    int numberOfTowns, numberOfRoads;
+    source >> numberOfTowns >> numberOfRoads;
+
+    std::vector<std::string> names(numberOfTowns);
+    std::map<std::string, int> nameMap;
+
+    // Read town names
+    for (int i = 0; i < numberOfTowns; i++) {
+        source >> names[i];
+        nameMap[names[i]] = i;
+    }
+
+    // Read roads
+    std::vector<Road> roads;
+    std::vector<int> numberOfEnds(numberOfTowns, 0);
+    for (int i = 0; i < numberOfRoads; i++) {
+        std::string tail, head;
+        source >> tail >> head;
+        int tailIndex = nameMap[tail];  // index of the first town
+        int headIndex = nameMap[head];  // index of the second town
+
+        // Get type of road (B for bridge, N for normal) and length
+        char type;
+        double length;
+        source >> type >> length;
+
+        roads.push_back(Road(headIndex, tailIndex, type == 'B', length));
+        numberOfEnds[tailIndex]++;
+        numberOfEnds[headIndex]++;
+    }
+
+    // Lay out segment
+    size_t namesOffset = roadsOffset(numberOfTowns, numberOfRoads) +
+                         static_cast<size_t>(numberOfRoads) * sizeof(Road);
+    size_t size = namesOffset;
+    for (int i = 0; i < numberOfTowns; i++) {
+        size += names[i].size() + 1;
+    }
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd == -1 && errno == EEXIST) {
+        throw std::runtime_error("Segment " + name + " already exists; " +
+                                 "remove it with -u first");
+    } else if (fd == -1) {
+        throw std::runtime_error("Could not create segment " + name);
+    }
+    if (ftruncate(fd, size) == -1) {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Could not size segment " + name);
+    }
+    void *mapped = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                        fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw std::runtime_error("Could not map segment " + name);
+    }
+    char *base = static_cast<char *>(mapped);
+
+    // Fill in towns and their names
+    Town *towns = reinterpret_cast<Town *>(base + sizeof(Header));
+    size_t nameOffset = 0;
+    int firstEnd = 0;
+    for (int i = 0; i < numberOfTowns; i++) {
+        towns[i]._name = nameOffset;
+        towns[i]._firstEnd = firstEnd;
+        towns[i]._numberOfEnds = 0;
+        std::memcpy(base + namesOffset + nameOffset, names[i].c_str(),
+                    names[i].size() + 1);
+        nameOffset += names[i].size() + 1;
+        firstEnd += numberOfEnds[i];
+    }
+
+    // Add each road to both towns it connects, in input order
+    Road *ends = reinterpret_cast<Road *>(base + endsOffset(numberOfTowns));
+    Road *roadList = reinterpret_cast<Road *>(base +
+        roadsOffset(numberOfTowns, numberOfRoads));
+    for (int i = 0; i < numberOfRoads; i++) {
+        const Road & newRoad = roads[i];
+        roadList[i] = newRoad;
+
+        Town & tailTown = towns[newRoad._tail];
+        ends[tailTown._firstEnd + tailTown._numberOfEnds++] =
+            Road(newRoad._head, newRoad._tail, newRoad._isBridge,
+                 newRoad._length);
+
+        Town & headTown = towns[newRoad._head];
+        ends[headTown._firstEnd + headTown._numberOfEnds++] =
+            Road(newRoad._tail, newRoad._head, newRoad._isBridge,
+                 newRoad._length);
+    }
+
+    // Header goes last, and the fence keeps everything above from being
+    // reordered past the magic number, so a reader never sees a
+    // half-built segment with a valid magic number
+    Header *header = reinterpret_cast<Header *>(base);
+    header->_version = VERSION;
+    header->_numberOfTowns = numberOfTowns;
+    header->_numberOfRoads = numberOfRoads;
+    header->_endsOffset = endsOffset(numberOfTowns);
+    header->_roadsOffset = roadsOffset(numberOfTowns, numberOfRoads);
+    header->_namesOffset = namesOffset;
+    header->_size = size;
+    __sync_synchronize();
+    std::memcpy(header->_magic, MAGIC, sizeof(MAGIC));
+
+    munmap(mapped, size);
+}
+
+/*
+* Remove a published segment
+* @param name Name of segment
+*/
+void SharedProvince::unpublish(const std::string &name) {
+    shm_unlink(name.c_str());
+}
+
+/*
+* @param name Name of segment
+* @return     Whether a segment has been published under name
+*/
+bool SharedProvince::isPublished(const std::string &name) {
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+/*
+* Constructor
+* @param name Name of segment to attach to
+*/
+SharedProvince::SharedProvince(const std::string &name) {
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd == -1) {
+        throw std::runtime_error("Could not open segment " + name);
+    }
+
+    struct stat status;
+    if (fstat(fd, &status) == -1 ||
+        static_cast<size_t>(status.st_size) < sizeof(Header)) {
+        close(fd);
+        throw std::runtime_error("Segment " + name + " is not a province");
+    }
+    _size = status.st_size;
+
+    void *mapped = mmap(NULL, _size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Could not map segment " + name);
+    }
+    _base = static_cast<const char *>(mapped);
+
+    try {
+        check(name);
+    } catch (...) {
+        munmap(mapped, _size);
+        throw;
+    }
+}
+
+/*
+* Make sure the segment was fully published by this layout version,
+* that everything the header and towns point at lies inside it, and
+* that every end and road connects towns that exist
+* @param name Name of segment, for errors
+*/
+void SharedProvince::check(const std::string &name) const {
+    const Header & segment = header();
+    if (std::memcmp(segment._magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Segment " + name + " is not a province " +
+                                 "or was never finished");
+    }
+    if (segment._version != VERSION) {
+        throw std::runtime_error("Segment " + name + " was published by " +
+                                 "a different version; publish it again");
+    }
+
+    // Offsets must be exactly where publish puts them for these counts
+    int numberOfTowns = segment._numberOfTowns;
+    int numberOfRoads = segment._numberOfRoads;
+    if (numberOfTowns < 1 || numberOfRoads < 0 ||
+        segment._size != _size ||
+        segment._endsOffset != endsOffset(numberOfTowns) ||
+        segment._roadsOffset != roadsOffset(numberOfTowns, numberOfRoads) ||
+        segment._namesOffset != segment._roadsOffset +
+            static_cast<size_t>(numberOfRoads) * sizeof(Road) ||
+        segment._namesOffset >= _size || _base[_size - 1] != '\0') {
+        throw std::runtime_error("Segment " + name + " is damaged");
+    }
+
+    // Each town's name and ends must lie inside the segment
+    size_t namesSize = _size - segment._namesOffset;
+    size_t numberOfEnds = 2 * static_cast<size_t>(numberOfRoads);
+    for (int i = 0; i < numberOfTowns; i++) {
+        const Town & current = town(i);
+        if (current._name >= namesSize || current._firstEnd < 0 ||
+            current._numberOfEnds < 0 ||
+            static_cast<size_t>(current._firstEnd) +
+            static_cast<size_t>(current._numberOfEnds) > numberOfEnds) {
+            throw std::runtime_error("Segment " + name + " is damaged");
+        }
+    }
+
+    // Every end and road must connect towns that exist
+    const Road *ends = reinterpret_cast<const Road *>(_base +
+                                                      segment._endsOffset);
+    const Road *roads = reinterpret_cast<const Road *>(_base +
+                                                       segment._roadsOffset);
+    for (size_t i = 0; i < numberOfEnds; i++) {
+        if (!connectsTowns(ends[i], numberOfTowns)) {
+            throw std::runtime_error("Segment " + name + " is damaged");
+        }
+    }
+    for (int i = 0; i < numberOfRoads; i++) {
+        if (!connectsTowns(roads[i], numberOfTowns)) {
+            throw std::runtime_error("Segment " + name + " is damaged");
+        }
+    }
+}
+
+/**
+ * Destructor
+ */
+SharedProvince::~SharedProvince() {
+    munmap(const_cast<char *>(_base), _size);
+}
+
+const SharedProvince::Header & SharedProvince::header() const {
+    return *reinterpret_cast<const Header *>(_base);
+}
+
+const SharedProvince::Town & SharedProvince::town(int index) const {
+    return reinterpret_cast<const Town *>(_base + sizeof(Header))[index];
+}
+
+const char * SharedProvince::name(int town) const {
+    return _base + header()._namesOffset + this->town(town)._name;
+}
+
+const ProvinceGraph::Road & SharedProvince::end(int town, int index) const {
+    const Road *ends = reinterpret_cast<const Road *>(_base +
+                                                      header()._endsOffset);
+    return ends[this->town(town)._firstEnd + index];
+}
+
+const ProvinceGraph::Road & SharedProvince::road(int index) const {
+    return reinterpret_cast<const Road *>(_base +
+                                          header()._roadsOffset)[index];
+}
@@ -0,0 +1,113 @@
+/*
+ * Class declaration for SharedProvince
+ * Copyright Adam Vigneaux and Jordan Hunt
+ * Based on files by Dr. Bjork
+*/
+
+#ifndef SHAREDPROVINCE_H
+#define SHAREDPROVINCE_H
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include "./provincegraph.h"
+
+/**
+ * SharedProvince
+ * Province published once into a named POSIX shared memory segment and
+ * attached read-only by any number of processes, which run the
+ * ProvinceGraph analyses directly against the segment. Everything in
+ * the segment refers to everything else by index or offset, never by
+ * pointer, so it reads the same wherever it is mapped. Attaching checks
+ * every town, end and road once, so a damaged segment is refused rather
+ * than read out of bounds.
+ */
+class SharedProvince : public ProvinceGraph
+{
+public:
+
+    /**
+     * Read a province and publish it into a new shared memory segment
+     * @param source Input data for province, in the same format read
+     *               by Province
+     * @param name Name of segment, starting with '/'
+     */
+    static void publish(std::istream & source, const std::string & name);
+
+    /**
+     * Remove a published segment; processes attached to it keep it
+     * until they detach
+     * @param name Name of segment
+     */
+    static void unpublish(const std::string & name);
+
+    /**
+     * @param name Name of segment
+     * @return     Whether a segment has been published under name
+     */
+    static bool isPublished(const std::string & name);
+
+    /**
+     * Constructor
+     * Attach read-only to a published segment
+     * @param name Name of segment
+     */
+    SharedProvince(const std::string & name);
+
+    /**
+     * Destructor
+     * Detach from the segment
+     */
+    ~SharedProvince();
+
+protected:
+
+    int numberOfTowns() const { return header()._numberOfTowns; }
+    int numberOfRoads() const { return header()._numberOfRoads; }
+    const char * name(int town) const;
+    int numberOfEnds(int town) const { return this->town(town)._numberOfEnds; }
+    const Road & end(int town, int index) const;
+    const Road & road(int index) const;
+
+private:
+
+    // The mapping cannot be shared between copies
+    SharedProvince(const SharedProvince &);
+    SharedProvince & operator = (const SharedProvince &);
+
+    /*
+     * Layout of segment: a Header, then numberOfTowns Towns, then each
+     * town's ends back to back, then numberOfRoads roads in input order,
+     * then the town names as null-terminated strings. Ends and roads are
+     * both stored as Roads.
+     */
+    struct Header {
+        char _magic[8];
+        int _version;      // Bumped whenever the layout changes
+        int _numberOfTowns;
+        int _numberOfRoads;
+        size_t _endsOffset;
+        size_t _roadsOffset;
+        size_t _namesOffset;
+        size_t _size;
+    };
+
+    struct Town {
+        size_t _name;      // Offset of name from start of names
+        int _firstEnd;     // Index of first of this town's ends
+        int _numberOfEnds;
+    };
+
+    static size_t endsOffset(int numberOfTowns);
+    static size_t roadsOffset(int numberOfTowns, int numberOfRoads);
+
+    void check(const std::string & name) const;
+
+    const Header & header() const;
+    const Town & town(int index) const;
+
+    const char *_base;
+    size_t _size;
+};
+
+#endif
@@ -0,0 +1,508 @@
+/*
+* Implementation of streamprovince.h
+* Copyright 2016 Adam Vigneaux and Jordan Hunt
+* Based on algorithms by Dr. Bjork
+*/
+
+#include "./streamprovince.h"
+#include "./unionfind.h"
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+/*
+ * Road as written to a run of roads sorted by length
+ */
+struct SpilledRoad {
+    int _head;
+    int _tail;
+    double _length;
+};
+
+/*
+ * One end of a non-bridge road, as written to a run sorted by town
+ */
+struct SpilledEnd {
+    int _town;
+    int _neighbor;
+};
+
+bool shorter(const SpilledRoad & road1, const SpilledRoad & road2) {
+    return road1._length < road2._length;
+}
+
+bool lowerTown(const SpilledEnd & end1, const SpilledEnd & end2) {
+    return end1._town < end2._town;
+}
+
+double lengthOf(const SpilledRoad & road) {
+    return road._length;
+}
+
+int townOf(const SpilledEnd & end) {
+    return end._town;
+}
+
+// Most runs merged at once, and records buffered for each of them, so
+// merging takes the same memory however many roads there are
+const int MERGE_FAN_IN = 16;
+const long RUN_BUFFER = 4096;
+
+/*
+ * Reads a run of records back from a temporary file a buffer at a time
+ */
+template <class Record>
+class RunReader {
+public:
+    RunReader(std::FILE *file, long start, long count)
+        : _file(file), _next(start), _remaining(count), _pos(0) {
+        refill();
+    }
+
+    bool empty() const { return _pos == _buffer.size(); }
+
+    const Record & front() const { return _buffer[_pos]; }
+
+    void pop() {
+        _pos++;
+        if (_pos == _buffer.size()) {
+            refill();
+        }
+    }
+
+private:
+    void refill() {
+        long count = std::min(_remaining, RUN_BUFFER);
+        _buffer.resize(count);
+        _pos = 0;
+        if (count == 0) {
+            return;
+        }
+        std::fseek(_file, _next * sizeof(Record), SEEK_SET);
+        if (std::fread(&_buffer[0], sizeof(Record), count, _file) !=
+            static_cast<size_t>(count)) {
+            throw std::runtime_error("Could not read back spilled roads");
+        }
+        _next += count;
+        _remaining -= count;
+    }
+
+    std::FILE *_file;
+    long _next;
+    long _remaining;
+    std::vector<Record> _buffer;
+    size_t _pos;
+};
+
+/*
+ * Append records to a temporary file
+ * @param file File to append to
+ * @param records Records to write; emptied afterwards
+ * @param written Number of records in file so far
+ */
+template <class Record>
+void appendRecords(std::FILE *file, std::vector<Record> & records,
+                   long & written) {
+    if (records.empty()) {
+        return;
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    if (std::fwrite(&records[0], sizeof(Record), records.size(), file) !=
+        records.size()) {
+        throw std::runtime_error("Could not spill roads to disk");
+    }
+
+    written += records.size();
+    records.clear();
+}
+
+/*
+ * Sort a chunk of records and append it to a temporary file as a run
+ * @param file File to append run to
+ * @param chunk Records to write; emptied afterwards
+ * @param runStart Offsets of runs in file; offset of new run is added
+ * @param written Number of records in file so far
+ * @param less Ordering of records
+ */
+template <class Record>
+void spillRun(std::FILE *file, std::vector<Record> & chunk,
+              std::vector<long> & runStart, long & written,
+              bool (*less)(const Record &, const Record &)) {
+    if (chunk.empty()) {
+        return;
+    }
+
+    // Stable, so equal records keep the order they were read in
+    std::stable_sort(chunk.begin(), chunk.end(), less);
+
+    runStart.push_back(written);
+    appendRecords(file, chunk, written);
+}
+
+/*
+ * Merges a range of runs in a file of runs, in order of key; ties go to
+ * the earlier run so equal records keep the order they were read in
+ */
+template <class Record, class Key>
+class RunMerger {
+public:
+    /*
+     * @param file File of runs
+     * @param runStart Offsets of runs in file
+     * @param total Number of records in file
+     * @param first Index of first run to merge
+     * @param last Index just past last run to merge
+     * @param key Key records are merged by
+     */
+    RunMerger(std::FILE *file, const std::vector<long> & runStart,
+              long total, int first, int last, Key (*key)(const Record &))
+        : _key(key) {
+        _runs.reserve(last - first);
+        for (int i = first; i < last; i++) {
+            long end = (i + 1 < runStart.size()) ? runStart[i + 1] : total;
+            _runs.push_back(RunReader<Record>(file, runStart[i],
+                                              end - runStart[i]));
+            if (!_runs.back().empty()) {
+                _next.push(std::make_pair(_key(_runs.back().front()),
+                                          i - first));
+            }
+        }
+    }
+
+    bool empty() const { return _next.empty(); }
+
+    const Record & front() const { return _runs[_next.top().second].front(); }
+
+    void pop() {
+        int run = _next.top().second;
+        _next.pop();
+        _runs[run].pop();
+        if (!_runs[run].empty()) {
+            _next.push(std::make_pair(_key(_runs[run].front()), run));
+        }
+    }
+
+private:
+    Key (*_key)(const Record &);
+    std::vector<RunReader<Record> > _runs;
+    std::priority_queue<std::pair<Key, int>,
+                        std::vector<std::pair<Key, int> >,
+                        std::greater<std::pair<Key, int> > > _next;
+};
+
+/*
+ * Temporary file closed when it goes out of scope, unless released
+ */
+class TemporaryFile {
+public:
+    TemporaryFile() : _file(std::tmpfile()) {}
+
+    ~TemporaryFile() {
+        if (_file != NULL) {
+            std::fclose(_file);
+        }
+    }
+
+    std::FILE * get() const { return _file; }
+
+    void swap(TemporaryFile & other) {
+        std::swap(_file, other._file);
+    }
+
+    std::FILE * release() {
+        std::FILE *file = _file;
+        _file = NULL;
+        return file;
+    }
+
+private:
+    TemporaryFile(const TemporaryFile &);
+    TemporaryFile & operator = (const TemporaryFile &);
+
+    std::FILE *_file;
+};
+
+/*
+ * Merge runs MERGE_FAN_IN at a time into longer runs, as many passes as
+ * it takes to leave at most MERGE_FAN_IN runs
+ * @param file File of runs; replaced by the file of merged runs
+ * @param runStart Offsets of runs in file; replaced by merged offsets
+ * @param total Number of records in file
+ * @param key Key records are merged by
+ */
+template <class Record, class Key>
+void reduceRuns(TemporaryFile & file, std::vector<long> & runStart,
+                long total, Key (*key)(const Record &)) {
+    while (runStart.size() > MERGE_FAN_IN) {
+        TemporaryFile merged;
+        if (merged.get() == NULL) {
+            throw std::runtime_error("Could not create temporary files");
+        }
+
+        std::vector<long> mergedStart;
+        std::vector<Record> buffer;
+        long written = 0;
+        for (int first = 0; first < runStart.size(); first += MERGE_FAN_IN) {
+            int last = std::min<int>(first + MERGE_FAN_IN, runStart.size());
+            mergedStart.push_back(written);
+
+            RunMerger<Record, Key> runs(file.get(), runStart, total,
+                                        first, last, key);
+            for (; !runs.empty(); runs.pop()) {
+                buffer.push_back(runs.front());
+                if (buffer.size() == RUN_BUFFER) {
+                    appendRecords(merged.get(), buffer, written);
+                }
+            }
+            appendRecords(merged.get(), buffer, written);
+        }
+
+        file.swap(merged);
+        runStart.swap(mergedStart);
+    }
+}
+
+}  // namespace
+
+/*
+* Constructor
+* Reads the same format as Province, but holds at most chunkSize roads
+* in memory at once. Each chunk is sorted twice and spilled: once by
+* length for minSpan, and once by town for the non-bridge neighbors
+* used by removeBridges. Runs are merged MERGE_FAN_IN at a time until
+* few enough are left to merge in one go, and the runs by town are then
+* merged into a single neighbor file indexed by town.
+* @param source File containing province
+* @param chunkSize Number of roads to hold in memory at a time
+*/
+StreamingProvince::StreamingProvince(std::istream &source, int chunkSize)
+    : _hasBridge(false), _roadRuns(NULL), _adjacency(NULL) {
+    // Read first line of input
+    source >> _numberOfTowns >> _numberOfRoads;
+
+    _names.resize(_numberOfTowns);
+    std::map<std::string, int> nameMap;
+
+    // Read town names
+    for (int i = 0; i < _numberOfTowns; i++) {
+        source >> _names[i];
+        nameMap[_names[i]] = i;
+    }
+
+    // Closed again if anything below throws
+    TemporaryFile roadRuns;
+    TemporaryFile adjacency;
+    TemporaryFile endRuns;
+    if (roadRuns.get() == NULL || adjacency.get() == NULL ||
+        endRuns.get() == NULL) {
+        throw std::runtime_error("Could not create temporary files");
+    }
+
+    std::vector<SpilledRoad> roads;
+    std::vector<SpilledEnd> ends;
+    std::vector<long> endRunStart;
+    long roadsWritten = 0;
+    long endsWritten = 0;
+
+    // Read roads a chunk at a time
+    for (int i = 0; i < _numberOfRoads; i++) {
+        std::string tail, head;
+        source >> tail >> head;
+        int tailIndex = nameMap[tail];  // index of the first town
+        int headIndex = nameMap[head];  // index of the second town
+
+        // Get type of road (B for bridge, N for normal)
+        char type;
+        source >> type;
+        bool isBridge = (type == 'B');
+
+        // Get length of road
+        double length;
+        source >> length;
+
+        SpilledRoad road = { headIndex, tailIndex, length };
+        roads.push_back(road);
+
+        // Add non-bridge road to both towns it connects
+        if (isBridge) {
+            _hasBridge = true;
+        } else {
+            SpilledEnd tailEnd = { tailIndex, headIndex };
+            SpilledEnd headEnd = { headIndex, tailIndex };
+            ends.push_back(tailEnd);
+            ends.push_back(headEnd);
+        }
+
+        if (roads.size() == chunkSize) {
+            spillRun(roadRuns.get(), roads, _roadRunStart, roadsWritten,
+                     shorter);
+            spillRun(endRuns.get(), ends, endRunStart, endsWritten,
+                     lowerTown);
+        }
+    }
+    spillRun(roadRuns.get(), roads, _roadRunStart, roadsWritten, shorter);
+    spillRun(endRuns.get(), ends, endRunStart, endsWritten, lowerTown);
+
+    // Merge runs by town into one list of neighbors, ties going to the
+    // earlier run so each town's neighbors stay in input order
+    reduceRuns(roadRuns, _roadRunStart, roadsWritten, lengthOf);
+    reduceRuns(endRuns, endRunStart, endsWritten, townOf);
+
+    _adjacencyStart.assign(_numberOfTowns + 1, 0);
+    std::vector<int> neighbors;
+    long neighborsWritten = 0;
+    RunMerger<SpilledEnd, int> byTown(endRuns.get(), endRunStart,
+        endsWritten, 0, endRunStart.size(), townOf);
+    for (; !byTown.empty(); byTown.pop()) {
+        _adjacencyStart[byTown.front()._town + 1]++;
+        neighbors.push_back(byTown.front()._neighbor);
+        if (neighbors.size() == RUN_BUFFER) {
+            appendRecords(adjacency.get(), neighbors, neighborsWritten);
+        }
+    }
+    appendRecords(adjacency.get(), neighbors, neighborsWritten);
+
+    // Turn neighbor counts into offsets
+    for (int i = 0; i < _numberOfTowns; i++) {
+        _adjacencyStart[i + 1] += _adjacencyStart[i];
+    }
+
+    _roadRuns = roadRuns.release();
+    _adjacency = adjacency.release();
+}
+
+/**
+ * Destructor
+ */
+StreamingProvince::~StreamingProvince() {
+    if (_roadRuns != NULL) {
+        std::fclose(_roadRuns);
+    }
+    if (_adjacency != NULL) {
+        std::fclose(_adjacency);
+    }
+}
+
+/**
+ * Find minimum spanning tree of the province by merging the runs of
+ * roads and joining components with a union-find
+ * @param output Stream to print output to
+ */
+void StreamingProvince::minSpan(std::ostream & output) const {
+
+    // Bypass entire function if only one town
+    if (_numberOfTowns == 1) {
+        output << "There is only one town, so the province "
+               << "does not need to upgrade any roads!";
+        return;
+    }
+
+    output << "The road upgrading goal can be achieved at minimal cost by upgrading:";
+    output << std::endl << std::endl;
+
+    // Each town starts in a component of its own
+    UnionFind components(_numberOfTowns);
+
+    // Merge runs by length, ties going to the earlier run so roads of
+    // equal length are taken in input order
+    RunMerger<SpilledRoad, double> roads(_roadRuns, _roadRunStart,
+        _numberOfRoads, 0, _roadRunStart.size(), lengthOf);
+
+    int treeSize = 0;
+    for (; treeSize < _numberOfTowns - 1 && !roads.empty(); roads.pop()) {
+        SpilledRoad minRoad = roads.front();
+
+        // Skip roads that would form a cycle
+        if (!components.join(minRoad._head, minRoad._tail)) {
+            continue;
+        }
+        treeSize++;
+
+        output << "      ";
+        output << _names[minRoad._head];
+        output << " to ";
+        output << _names[minRoad._tail] << std::endl;
+    }
+}
+
+/**
+ * Conduct a breadth-first traversal on the province, ignoring bridges
+ * @param start Index of town to start traversal at
+ * @param visited Towns already traversed; updated with towns reached
+ * @return      List of indices of towns in order of traversal
+ */
+std::vector<int> StreamingProvince::bfs(int start,
+                                        std::vector<bool> & visited) const {
+    std::queue<int> toVisit;
+    toVisit.push(start);
+    visited[start] = true;
+    std::vector<int> results;
+
+    while (!toVisit.empty()) {
+        int current = toVisit.front();
+        toVisit.pop();
+        results.push_back(current);
+
+        // Read current town's neighbors back from disk
+        RunReader<int> neighbor(_adjacency, _adjacencyStart[current],
+            _adjacencyStart[current + 1] - _adjacencyStart[current]);
+        for (; !neighbor.empty(); neighbor.pop()) {
+            if (!visited[neighbor.front()]) {
+                toVisit.push(neighbor.front());
+                visited[neighbor.front()] = true;
+            }
+        }
+    }
+
+    return results;
+}
+
+/**
+ * Remove bridges and print the list of towns that remain connected,
+ * visiting groups in the same order as Province::removeBridges
+ * @param output Stream to print output to
+ */
+void StreamingProvince::removeBridges(std::ostream &output) const {
+
+    // Bypass entire function if only one town
+    if (_numberOfTowns == 1) {
+        output << "There is only one town, so the province "
+               << "will not be affected by a major storm!";
+        return;
+
+    // Bypass entire function if province has no bridges
+    } else if (!_hasBridge) {
+        output << "The province has no bridges, so it "
+               << "will not be affected by a major storm!";
+        return;
+    }
+
+    output << "Connected components in event of a major storm are: ";
+    output << std::endl << std::endl;
+
+    // Start a new group from the last town not yet visited
+    std::vector<bool> visited(_numberOfTowns, false);
+    for (int curr = _numberOfTowns - 1; curr >= 0; curr--) {
+        if (visited[curr]) {
+            continue;
+        }
+
+        std::vector<int> bfsResult = bfs(curr, visited);
+
+        output << "      ";
+        output << "If all bridges fail, the following towns would form ";
+        output << "an isolated group:" << std::endl;
+
+        // Print names of all towns in connected component
+        for (int i = 0; i < bfsResult.size(); i++) {
+            output << "            ";
+            output << _names[bfsResult[i]] << std::endl;
+        }
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Class declaration for StreamingProvince
+ * Copyright Adam Vigneaux and Jordan Hunt
+ * Based on files by Dr. Bjork
+*/
+
+#ifndef STREAMPROVINCE_H
+#define STREAMPROVINCE_H
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * StreamingProvince
+ * Province too large to hold its roads in memory. Only the towns are
+ * kept; roads are read in chunks and spilled to temporary files as
+ * sorted runs, which are merged back in when the roads are needed.
+ * Besides the towns, memory holds one chunk of roads and a fixed-size
+ * buffer for each of the few runs merged at a time.
+ */
+class StreamingProvince
+{
+public:
+
+    /**
+     * Constructor
+     * @param source Input data for province, in the same format read
+     *               by Province
+     * @param chunkSize Number of roads to hold in memory at a time
+     */
+    StreamingProvince(std::istream & source, int chunkSize = 1 << 20);
+
+    /**
+     * Print the same minimum spanning tree as Province::minSpan
+     * @param output Stream to print output to
+     */
+    void minSpan(std::ostream & output) const;
+
+    /**
+     * Print the same isolated groups as Province::removeBridges
+     * @param output Stream to print output to
+     */
+    void removeBridges(std::ostream & output) const;
+
+    /**
+     * Destructor
+     */
+    ~StreamingProvince();
+
+private:
+
+    // Temporary files cannot be shared between copies
+    StreamingProvince(const StreamingProvince &);
+    StreamingProvince & operator = (const StreamingProvince &);
+
+    std::vector<int> bfs(int start, std::vector<bool> & visited) const;
+
+    int _numberOfTowns;
+    int _numberOfRoads;
+    bool _hasBridge;
+    std::vector<std::string> _names;
+
+    // All roads, as runs sorted by length
+    std::FILE *_roadRuns;
+    std::vector<long> _roadRunStart;
+
+    // Neighbors of each town across non-bridge roads, in input order
+    std::FILE *_adjacency;
+    std::vector<long> _adjacencyStart;
+};
+
+#endif
@@ -0,0 +1,43 @@
+/*
+* Implementation of unionfind.h
+* Copyright 2016 Adam Vigneaux and Jordan Hunt
+*/
+
+#include "./unionfind.h"
+
+/*
+* Constructor
+* @param numberOfTowns Number of towns
+*/
+UnionFind::UnionFind(int numberOfTowns) : _parent(numberOfTowns) {
+    for (int i = 0; i < numberOfTowns; i++) {
+        _parent[i] = i;
+    }
+}
+
+/*
+* Find the representative of a town's component, halving the path to it
+* @param town Index of town
+* @return     Representative of town's component
+*/
+int UnionFind::find(int town) {
+    while (_parent[town] != town) {
+        _parent[town] = _parent[_parent[town]];
+        town = _parent[town];
+    }
+    return town;
+}
+
+/*
+* Join the components of two towns
+* @return True if they were in different components
+*/
+bool UnionFind::join(int town1, int town2) {
+    int component1 = find(town1);
+    int component2 = find(town2);
+    if (component1 == component2) {
+        return false;
+    }
+    _parent[component1] = component2;
+    return true;
+}
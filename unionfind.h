@@ -0,0 +1,41 @@
+/*
+ * Class declaration for UnionFind
+ * Copyright Adam Vigneaux and Jordan Hunt
+*/
+
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+#include <vector>
+
+/**
+ * UnionFind
+ * Keeps track of which towns have been joined into the same component
+ */
+class UnionFind
+{
+public:
+
+    /**
+     * Constructor
+     * @param numberOfTowns Number of towns, each in a component of its own
+     */
+    UnionFind(int numberOfTowns);
+
+    /**
+     * @param town Index of town
+     * @return     Representative of town's component
+     */
+    int find(int town);
+
+    /**
+     * Join the components of two towns
+     * @return True if they were in different components
+     */
+    bool join(int town1, int town2);
+
+private:
+    std::vector<int> _parent;
+};
+
+#endif